@@ -0,0 +1,556 @@
+/*
+    Batch driver: run any of the Arrays/ solutions over many inputs at once.
+
+    Usage:
+        batch-driver <solution> [--binary] [--threads N] [input-file]
+
+        <solution> is the file name without ".cpp":
+            count-inversion, longest-consecutive-sequence,
+            majority-elementsNby3times, reverse-pairs, unique-paths-in-grid
+
+        Reads from input-file, or from stdin when it is omitted or "-".
+        Writes one output line per input record to stdout, in input order.
+
+    Input formats:
+    ---------------------------------------------------------
+    1) Text (default)
+       One record per line, integers separated by spaces/tabs.
+       An empty line is an empty array.
+       unique-paths-in-grid expects exactly two integers per line: "m n".
+
+            5 3 2 1        ->  6         (count-inversion)
+            100 4 200 1 3 2  ->  4       (longest-consecutive-sequence)
+
+    2) Binary (--binary)
+       Length-prefixed records of native-endian int32:
+            [n] [a0] [a1] ... [a(n-1)]  [n] [a0] ...
+       unique-paths-in-grid records are [2] [m] [n].
+
+    Output:
+       count-inversion / longest-consecutive-sequence / reverse-pairs /
+       unique-paths-in-grid print one number; majority-elementsNby3times
+       prints the elements separated by spaces (empty line if none).
+
+    Errors:
+       On the first bad record (bad integer, wrong count, ...) every record
+       before it is still written, then the driver prints
+            batch-driver: line N: <reason>      (record N: in binary mode)
+       to stderr, writes nothing more and exits with status 1.
+
+    How it works (parse -> compute -> emit pipeline):
+    ---------------------------------------------------------
+       reader thread (main) : reads the input in 1 MiB blocks and cuts each
+                              block at the last complete record (newline in
+                              text mode, full length-prefixed record in binary)
+       thread pool          : each chunk is parsed, solved record by record
+                              and formatted into a string, all on one worker
+       emitter thread       : waits on the chunk results in submission order
+                              and writes them to stdout
+
+       So while the emitter is writing chunk k, workers are computing k+1..
+       and the reader is already reading the next block.
+       The number of chunks in flight is bounded, so memory stays flat on
+       huge inputs.
+
+       Integers are parsed with std::from_chars (no locale, no iostream
+       state, no allocation), which is what makes the text path fast.
+
+    Build:
+        g++ -std=c++17 -O2 -pthread batch-driver.cpp -o batch-driver
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// Every solution file declares its own "class Solution", so each one is
+// pulled into a namespace of its own. The std headers they need are already
+// included above, so their own #include lines are no-ops here.
+// Including a std header inside a namespace is not allowed by the standard;
+// this only works because of include guards. So every std header a solution
+// file includes MUST also be in the list above. Add it there first when a
+// solution gains a new #include.
+namespace count_inversion {
+    using namespace std;
+    #include "count-inversion.cpp"
+}
+namespace longest_consecutive_sequence {
+    using namespace std;
+    #include "longest-consecutive-sequence.cpp"
+}
+namespace majority_elements_n_by_3 {
+    using namespace std;
+    #include "majority-elementsNby3times.cpp"
+}
+namespace reverse_pairs {
+    using namespace std;
+    #include "reverse-pairs.cpp"
+}
+namespace unique_paths_in_grid {
+    using namespace std;
+    #include "unique-paths-in-grid.cpp"
+}
+
+using namespace std;
+
+static void appendInt(string &out, long long value)
+{
+    char buf[24];
+    auto res = to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, res.ptr);
+}
+
+// arity = number of integers a record must have (-1 = any length)
+struct Problem {
+    const char *name;
+    int arity;
+    void (*solve)(vector<int> &rec, string &out);
+};
+
+static const Problem problems[] = {
+    {"count-inversion", -1, [](vector<int> &rec, string &out) {
+        count_inversion::Solution s;
+        appendInt(out, s.inversionCount(rec));
+    }},
+    {"longest-consecutive-sequence", -1, [](vector<int> &rec, string &out) {
+        longest_consecutive_sequence::Solution s;
+        appendInt(out, s.longestConsecutive(rec));
+    }},
+    {"majority-elementsNby3times", -1, [](vector<int> &rec, string &out) {
+        majority_elements_n_by_3::Solution s;
+        vector<int> ans = s.majorityElement(rec);
+        for (size_t i = 0; i < ans.size(); i++) {
+            if (i) out.push_back(' ');
+            appendInt(out, ans[i]);
+        }
+    }},
+    {"reverse-pairs", -1, [](vector<int> &rec, string &out) {
+        reverse_pairs::Solution s;
+        appendInt(out, s.reversePairs(rec));
+    }},
+    {"unique-paths-in-grid", 2, [](vector<int> &rec, string &out) {
+        if (rec[0] < 1 || rec[1] < 1) {
+            throw runtime_error("unique-paths-in-grid expects m >= 1 and n >= 1");
+        }
+        unique_paths_in_grid::Solution s;
+        long long paths = s.uniquePaths(rec[0], rec[1]);
+        if (paths < 0) throw runtime_error("unique-paths-in-grid result does not fit in 64 bits");
+        appendInt(out, paths);
+    }},
+};
+
+static void runRecord(const Problem &p, vector<int> &rec, string &out)
+{
+    if (p.arity >= 0 && (int)rec.size() != p.arity) {
+        throw runtime_error(string(p.name) + " expects " + to_string(p.arity) +
+                            " integers per record, got " + to_string(rec.size()));
+    }
+    p.solve(rec, out);
+    out.push_back('\n');
+}
+
+/* ---------------------------- parsing ---------------------------- */
+
+static inline bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Parse one text line [cur, end) into rec.
+static void parseLine(const char *cur, const char *end, vector<int> &rec)
+{
+    while (true) {
+        while (cur < end && isBlank(*cur)) cur++;
+        if (cur == end) return;
+
+        // from_chars does not accept a leading '+'; skip it only before a digit
+        const char *tok = cur;
+        if (*cur == '+' && cur + 1 < end && *(cur + 1) >= '0' && *(cur + 1) <= '9') cur++;
+        int value;
+        auto res = from_chars(cur, end, value);
+        if (res.ec != errc() || (res.ptr < end && !isBlank(*res.ptr))) {
+            cur = tok;
+            const char *tokEnd = cur;
+            while (tokEnd < end && !isBlank(*tokEnd)) tokEnd++;
+            throw runtime_error("bad integer '" + string(cur, tokEnd) + "'");
+        }
+        rec.push_back(value);
+        cur = res.ptr;
+    }
+}
+
+// What one chunk produced. On a bad record, `out` holds the records before
+// it, `records` is how many those are and `error` says what went wrong.
+// Chunks do not know their absolute position; the emitter adds it.
+struct ChunkResult {
+    string out;
+    size_t records = 0;
+    string error;
+};
+
+static ChunkResult solveTextChunk(const Problem &p, const string &chunk)
+{
+    ChunkResult res;
+    vector<int> rec;
+    const char *cur = chunk.data();
+    const char *end = cur + chunk.size();
+
+    while (cur < end) {
+        const char *eol = (const char *)memchr(cur, '\n', end - cur);
+        if (!eol) eol = end;
+        size_t outSize = res.out.size();
+        try {
+            rec.clear();
+            parseLine(cur, eol, rec);
+            runRecord(p, rec, res.out);
+        } catch (const exception &e) {
+            res.out.resize(outSize);
+            res.error = e.what();
+            return res;
+        }
+        res.records++;
+        cur = (eol == end) ? end : eol + 1;
+    }
+    return res;
+}
+
+static int32_t readInt32(const char *p)
+{
+    int32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Chunks handed to solveBinaryChunk always hold whole records
+// (the reader checks that with completeBinaryPrefix).
+static ChunkResult solveBinaryChunk(const Problem &p, const string &chunk)
+{
+    ChunkResult res;
+    vector<int> rec;
+    const char *cur = chunk.data();
+    const char *end = cur + chunk.size();
+
+    while (cur < end) {
+        int32_t n = readInt32(cur);
+        cur += sizeof(int32_t);
+        rec.resize(n);
+        if (n > 0) memcpy(rec.data(), cur, (size_t)n * sizeof(int32_t));
+        cur += (size_t)n * sizeof(int32_t);
+        size_t outSize = res.out.size();
+        try {
+            runRecord(p, rec, res.out);
+        } catch (const exception &e) {
+            res.out.resize(outSize);
+            res.error = e.what();
+            return res;
+        }
+        res.records++;
+    }
+    return res;
+}
+
+// Length of the longest prefix of buf[0..size) made of complete records.
+// Stops in front of a record with a negative length and sets badLength.
+static size_t completeBinaryPrefix(const char *buf, size_t size, bool &badLength)
+{
+    size_t pos = 0;
+    badLength = false;
+    while (size - pos >= sizeof(int32_t)) {
+        int32_t n = readInt32(buf + pos);
+        if (n < 0) {
+            badLength = true;
+            break;
+        }
+        size_t need = sizeof(int32_t) + (size_t)n * sizeof(int32_t);
+        if (size - pos < need) break;
+        pos += need;
+    }
+    return pos;
+}
+
+/* ------------------------- pipeline pieces ------------------------- */
+
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned count)
+    {
+        for (unsigned i = 0; i < count; i++) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            lock_guard<mutex> lock(mtx);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (auto &t : workers) t.join();
+    }
+
+    future<ChunkResult> submit(function<ChunkResult()> fn)
+    {
+        auto task = make_shared<packaged_task<ChunkResult()>>(std::move(fn));
+        future<ChunkResult> result = task->get_future();
+        {
+            lock_guard<mutex> lock(mtx);
+            tasks.emplace_back([task] { (*task)(); });
+        }
+        cv.notify_one();
+        return result;
+    }
+
+private:
+    void workerLoop()
+    {
+        while (true) {
+            function<void()> task;
+            {
+                unique_lock<mutex> lock(mtx);
+                cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+                // drain what is left before exiting
+                if (tasks.empty()) return;
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    vector<thread> workers;
+    deque<function<void()>> tasks;
+    mutex mtx;
+    condition_variable cv;
+    bool stopping = false;
+};
+
+// Chunk results in submission order; push blocks once `capacity` are pending.
+class OrderedResults {
+public:
+    explicit OrderedResults(size_t capacity) : capacity(capacity) {}
+
+    void push(future<ChunkResult> f)
+    {
+        unique_lock<mutex> lock(mtx);
+        notFull.wait(lock, [this] { return pending.size() < capacity; });
+        pending.push_back(std::move(f));
+        notEmpty.notify_one();
+    }
+
+    // false once closed and drained
+    bool pop(future<ChunkResult> &f)
+    {
+        unique_lock<mutex> lock(mtx);
+        notEmpty.wait(lock, [this] { return closed || !pending.empty(); });
+        if (pending.empty()) return false;
+        f = std::move(pending.front());
+        pending.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    void close()
+    {
+        lock_guard<mutex> lock(mtx);
+        closed = true;
+        notEmpty.notify_all();
+    }
+
+private:
+    size_t capacity;
+    deque<future<ChunkResult>> pending;
+    mutex mtx;
+    condition_variable notFull, notEmpty;
+    bool closed = false;
+};
+
+/* ------------------------------ main ------------------------------ */
+
+static void usage()
+{
+    fprintf(stderr, "usage: batch-driver <solution> [--binary] [--threads N] [input-file]\n");
+    fprintf(stderr, "solutions:\n");
+    for (const Problem &p : problems) fprintf(stderr, "    %s\n", p.name);
+}
+
+int main(int argc, char **argv)
+{
+    const Problem *problem = nullptr;
+    bool binary = false;
+    unsigned hw = thread::hardware_concurrency();
+    unsigned threads = hw > 1 ? hw - 1 : 1;
+    const char *inputPath = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--binary") {
+            binary = true;
+        } else if (arg == "--threads") {
+            if (i + 1 >= argc) {
+                usage();
+                return 2;
+            }
+            const char *val = argv[++i];
+            const char *valEnd = val + strlen(val);
+            int n = 0;
+            auto res = from_chars(val, valEnd, n);
+            if (res.ec != errc() || res.ptr != valEnd || n <= 0) {
+                usage();
+                return 2;
+            }
+            threads = (unsigned)n;
+        } else if (!problem) {
+            for (const Problem &p : problems) {
+                if (arg == p.name) problem = &p;
+            }
+            if (!problem) {
+                fprintf(stderr, "batch-driver: unknown solution '%s'\n", argv[i]);
+                usage();
+                return 2;
+            }
+        } else if (!inputPath) {
+            inputPath = argv[i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (!problem) {
+        usage();
+        return 2;
+    }
+
+    FILE *in = stdin;
+    if (inputPath && strcmp(inputPath, "-") != 0) {
+        in = fopen(inputPath, binary ? "rb" : "r");
+        if (!in) {
+            perror(inputPath);
+            return 1;
+        }
+    }
+
+    static char outBuf[1 << 16];
+    setvbuf(stdout, outBuf, _IOFBF, sizeof(outBuf));
+
+    const size_t blockSize = 1 << 20;
+    atomic<bool> failed(false);
+
+    auto reportOnce = [&failed](const char *msg) {
+        if (!failed.exchange(true)) fprintf(stderr, "batch-driver: %s\n", msg);
+    };
+
+    ThreadPool pool(threads);
+    OrderedResults results(2 * (size_t)threads + 2);
+
+    // Writes every record before the first bad one, then reports it as
+    // "line N" (text) or "record N" (binary) and writes nothing more.
+    thread emitter([&] {
+        future<ChunkResult> f;
+        size_t recordsDone = 0;
+        while (results.pop(f)) {
+            try {
+                ChunkResult res = f.get();
+                if (failed) continue;
+                if (fwrite(res.out.data(), 1, res.out.size(), stdout) != res.out.size()) {
+                    reportOnce("write error on stdout");
+                    continue;
+                }
+                recordsDone += res.records;
+                if (!res.error.empty()) {
+                    string msg = string(binary ? "record " : "line ") +
+                                 to_string(recordsDone + 1) + ": " + res.error;
+                    reportOnce(msg.c_str());
+                }
+            } catch (const exception &e) {
+                reportOnce(e.what());
+            }
+        }
+        if (fflush(stdout) != 0 || ferror(stdout)) reportOnce("write error on stdout");
+    });
+
+    auto submitChunk = [&](string chunk) {
+        const Problem &p = *problem;
+        if (binary) {
+            results.push(pool.submit([&p, chunk = std::move(chunk)] { return solveBinaryChunk(p, chunk); }));
+        } else {
+            results.push(pool.submit([&p, chunk = std::move(chunk)] { return solveTextChunk(p, chunk); }));
+        }
+    };
+
+    // Input errors found by the reader go through the same ordered queue,
+    // so everything before them is still written.
+    auto submitError = [&](string msg) {
+        promise<ChunkResult> ready;
+        ChunkResult res;
+        res.error = std::move(msg);
+        ready.set_value(std::move(res));
+        results.push(ready.get_future());
+    };
+
+    // carry = bytes after the last complete record, prepended to the next block
+    string carry;
+    try {
+        vector<char> block(blockSize);
+        while (!failed) {
+            size_t got = fread(block.data(), 1, blockSize, in);
+            if (got == 0) break;
+            size_t oldSize = carry.size();
+            carry.append(block.data(), got);
+
+            size_t cut;
+            bool badLength = false;
+            if (binary) {
+                cut = completeBinaryPrefix(carry.data(), carry.size(), badLength);
+            } else {
+                // carry had no newline before this block, so only the new
+                // bytes need scanning (keeps one huge line linear, not O(n^2))
+                size_t nl = got;
+                while (nl > 0 && block[nl - 1] != '\n') nl--;
+                cut = nl ? oldSize + nl : 0;
+            }
+            if (cut > 0) {
+                submitChunk(carry.substr(0, cut));
+                carry.erase(0, cut);
+            }
+            if (badLength) {
+                submitError("negative record length " + to_string(readInt32(carry.data())));
+                carry.clear();
+                break;
+            }
+        }
+        if (ferror(in)) throw runtime_error("read error");
+
+        if (!failed && !carry.empty()) {
+            if (binary) {
+                submitError("truncated record at end of input");
+            } else {
+                submitChunk(std::move(carry));
+            }
+        }
+    } catch (const exception &e) {
+        reportOnce(e.what());
+    }
+
+    results.close();
+    emitter.join();
+    if (in != stdin) fclose(in);
+
+    return failed ? 1 : 0;
+}
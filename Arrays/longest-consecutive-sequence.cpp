@@ -47,6 +47,7 @@
 #include <vector>
 #include <unordered_set>
 #include <algorithm>
+#include <climits>
 
 using namespace std;
 
@@ -64,13 +65,14 @@ public:
         for (int num : numSet) {
             // Check if 'num' is the start of a sequence
             // If (num - 1) exists, then 'num' is NOT the start. Skip it.
-            if (numSet.find(num - 1) == numSet.end()) {
+            // (INT_MIN has no num - 1, so it is always a start.)
+            if (num == INT_MIN || numSet.find(num - 1) == numSet.end()) {
                 
                 int currentNum = num;
                 int currentStreak = 1;
 
-                // Count consecutive numbers
-                while (numSet.find(currentNum + 1) != numSet.end()) {
+                // Count consecutive numbers (stop at INT_MAX, no num + 1)
+                while (currentNum != INT_MAX && numSet.find(currentNum + 1) != numSet.end()) {
                     currentNum += 1;
                     currentStreak += 1;
                 }
@@ -43,8 +43,9 @@
 class Solution {
 public:
     vector<int> majorityElement(vector<int>& nums) {
-        int cnt1 = 0, cnt2 = 0 ,el1,el2;
-        for(int i = 0; i < nums.size(); i++)
+        // candidates start as INT_MIN so the first comparisons are defined
+        int cnt1 = 0, cnt2 = 0, el1 = INT_MIN, el2 = INT_MIN;
+        for(size_t i = 0; i < nums.size(); i++)
         {
             if(cnt1 == 0 && el2 != nums[i])
             {
@@ -65,14 +66,15 @@ public:
         }
         cnt1 = 0;
         cnt2 = 0;
-        for(int i = 0; i < nums.size(); i++)
+        for(size_t i = 0; i < nums.size(); i++)
         {
             if(nums[i] == el1)  cnt1++;
             else if(nums[i] == el2)  cnt2++;
         }
         vector<int>ans;
-        if(cnt1 > nums.size() / 3)  ans.push_back(el1);
-        if(cnt2 > nums.size() / 3)  ans.push_back(el2);
+        int limit = nums.size() / 3;
+        if(cnt1 > limit)  ans.push_back(el1);
+        if(cnt2 > limit)  ans.push_back(el2);
         return ans;
     }
 };
\ No newline at end of file
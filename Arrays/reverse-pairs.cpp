@@ -34,6 +34,8 @@
 
     Note on "2LL": We use 2LL * nums[right] to prevent integer overflow when 
     nums[right] is a large integer (e.g., INT_MAX).
+    The counts are long long: up to n*(n-1)/2 pairs, which overflows int
+    once n is around 65536.
 */
 
 class Solution {
@@ -79,9 +81,9 @@ public:
     }
 
     // Function to count reverse pairs before merging
-    int findpairs(int start, int mid, int end, vector<int>& nums)
+    long long findpairs(int start, int mid, int end, vector<int>& nums)
     {
-        int cnt = 0;
+        long long cnt = 0;
         int right = mid + 1;
         
         for(int i = start; i <= mid; i++)
@@ -99,9 +101,9 @@ public:
     }
 
     // Recursive Merge Sort function
-    int mergesort(int start, int end, vector<int>& nums)
+    long long mergesort(int start, int end, vector<int>& nums)
     {
-        int cnt = 0;
+        long long cnt = 0;
         if(start >= end) return cnt;
         
         int mid = (start + end) / 2;
@@ -116,7 +118,7 @@ public:
         return cnt;
     }
 
-    int reversePairs(vector<int>& nums) {
+    long long reversePairs(vector<int>& nums) {
         return mergesort(0, nums.size() - 1, nums);
     }
 };
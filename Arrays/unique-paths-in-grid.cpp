@@ -54,21 +54,32 @@
         C(N, r) = (N-r+1)(N-r+2)...(N) / (1 · 2 · 3 ... r)
 
     This avoids overflow by multiplying/dividing step-by-step.
+    Each step first cancels gcd(ans, i), so the multiply can only
+    overflow when the answer itself does (then we return -1).
 
     Time Complexity  : O(min(m, n))
     Space Complexity : O(1)
 */
 class Solution {
 public:
-    int uniquePaths(int m, int n) {
-        int N = m + n - 2;
-        long ans = 1;
+    // Returns -1 if the count does not fit in a long long (expects m, n >= 1).
+    long long uniquePaths(int m, int n) {
+        long long N = (long long)m + n - 2;
+        unsigned long long ans = 1;
         int r = min(n , m) - 1;
         for(int i = 1; i <= r; i++)
         {
-            ans = ans * (N - r + i) / i;
+            // ans * (N - r + i) is always divisible by i. Divide by the
+            // common factor first so the multiply only overflows when the
+            // result itself does.
+            unsigned long long k = N - r + i;
+            unsigned long long g = gcd(ans, (unsigned long long)i);
+            unsigned long long a = ans / g;
+            k /= (i / g);
+            if(a > (unsigned long long)LLONG_MAX / k) return -1;
+            ans = a * k;
         }
-        return ans;
+        return (long long)ans;
     }
 };
 